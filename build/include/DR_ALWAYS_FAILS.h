@@ -0,0 +1 @@
+/* #undef DR_ALWAYS_FAILS */
@@ -0,0 +1 @@
+#define DR_ALWAYS_SUCCEEDS 1
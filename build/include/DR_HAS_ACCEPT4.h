@@ -0,0 +1 @@
+#define DR_HAS_ACCEPT4 1
@@ -0,0 +1 @@
+#define DR_HAS_ANON_STRUCT_FIELDS 1
@@ -0,0 +1 @@
+#define DR_HAS_ATTRIBUTE_FORCE_ALIGN_ARG_POINTER 1
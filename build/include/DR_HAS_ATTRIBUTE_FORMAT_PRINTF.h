@@ -0,0 +1 @@
+#define DR_HAS_ATTRIBUTE_FORMAT_PRINTF 1
@@ -0,0 +1 @@
+#define DR_HAS_ATTRIBUTE_NORETURN 1
@@ -0,0 +1 @@
+#define DR_HAS_ATTRIBUTE_WARN_UNUSED_RESULT 1
@@ -0,0 +1 @@
+#define DR_HAS_BUILTIN_EXPECT 1
@@ -0,0 +1 @@
+#define DR_HAS_COMPOUND_LITERALS 1
@@ -0,0 +1 @@
+/* #undef DR_HAS_DECLSPEC_NORETURN */
@@ -0,0 +1 @@
+#define DR_HAS_DESIGNATED_INITIALIZERS 1
@@ -0,0 +1 @@
+#define DR_HAS_IO_URING 1
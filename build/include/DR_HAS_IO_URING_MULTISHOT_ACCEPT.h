@@ -0,0 +1 @@
+#define DR_HAS_IO_URING_MULTISHOT_ACCEPT 1
@@ -0,0 +1 @@
+#define DR_HAS_MIXED_DECLARATIONS 1
@@ -0,0 +1 @@
+#define DR_HAS_NORETURN 1
@@ -0,0 +1 @@
+#define DR_HAS_RESTRICT 1
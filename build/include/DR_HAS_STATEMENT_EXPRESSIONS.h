@@ -0,0 +1 @@
+#define DR_HAS_STATEMENT_EXPRESSIONS 1
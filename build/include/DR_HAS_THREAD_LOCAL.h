@@ -0,0 +1 @@
+#define DR_HAS_THREAD_LOCAL 1
@@ -0,0 +1 @@
+#define DR_HAS_VARIADIC_MACROS 1
@@ -0,0 +1 @@
+#define DR_HAS___ALIGNOF 1
@@ -0,0 +1 @@
+#define DR_HAS___THREAD 1
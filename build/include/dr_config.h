@@ -0,0 +1,34 @@
+#if !defined(DR_CONFIG_H)
+#define DR_CONFIG_H
+/* #undef DR_ALWAYS_FAILS */
+#define DR_ALWAYS_SUCCEEDS 1
+#define DR_HAS_ACCEPT4 1
+#define DR_HAS_ANON_STRUCT_FIELDS 1
+#define DR_HAS_ATTRIBUTE_ALIGNED 1
+#define DR_HAS_ATTRIBUTE_FORCE_ALIGN_ARG_POINTER 1
+#define DR_HAS_ATTRIBUTE_FORMAT_PRINTF 1
+#define DR_HAS_ATTRIBUTE_NOINLINE 1
+#define DR_HAS_ATTRIBUTE_NORETURN 1
+#define DR_HAS_ATTRIBUTE_WARN_UNUSED_RESULT 1
+#define DR_HAS_BUILTIN_EXPECT 1
+#define DR_HAS_COMPOUND_LITERALS 1
+/* #undef DR_HAS_DECLSPEC_NOINLINE */
+/* #undef DR_HAS_DECLSPEC_NORETURN */
+/* #undef DR_HAS_DECLSPEC_THREAD */
+/* #undef DR_HAS_DECLTYPE */
+#define DR_HAS_DESIGNATED_INITIALIZERS 1
+#define DR_HAS_GENERIC 1
+#define DR_HAS_IO_URING 1
+#define DR_HAS_IO_URING_MULTISHOT_ACCEPT 1
+/* #undef DR_HAS_KEVENT */
+#define DR_HAS_MIXED_DECLARATIONS 1
+#define DR_HAS_NORETURN 1
+#define DR_HAS_RESTRICT 1
+#define DR_HAS_STATEMENT_EXPRESSIONS 1
+#define DR_HAS_THREAD_LOCAL 1
+#define DR_HAS_TYPEOF 1
+#define DR_HAS_VARIADIC_MACROS 1
+#define DR_HAS___ALIGNOF 1
+#define DR_HAS___ALIGNOF__ 1
+#define DR_HAS___THREAD 1
+#endif // DR_CONFIG_H
@@ -0,0 +1,6 @@
+#if !defined(DR_IDENTIFY_H)
+#define DR_IDENTIFY_H
+#define DR_MACHINE_X86_64
+#define DR_64_BIT
+#define DR_OS_LINUX
+#endif // DR_IDENTIFY_H
@@ -0,0 +1,12 @@
+#if !defined(DR_TYPES_H)
+#define DR_TYPES_H
+
+typedef struct { uint8_t  __private[0x0000000c]; } dr_event_t;
+typedef struct { uint8_t  __private[0x00000001]; } dr_overlapped_t;
+typedef struct { uint64_t __private[0x00000010]; } dr_sockaddr_t;
+typedef struct { uint64_t __private[0x00000005]; } dr_mutex_t;
+typedef struct { uint64_t __private[0x00000001]; } dr_thread_t;
+
+#include "dr_types_common.h"
+
+#endif // DR_TYPES_H\n
@@ -0,0 +1,10 @@
+#if !defined(DR_VERSION_H)
+#define DR_VERSION_H
+#define DR_VERSION_MAJOR 0
+#define DR_VERSION_MINOR 1
+#define DR_VERSION_PATCH 0
+#define DR_VERSION_MAJOR_STR "0"
+#define DR_VERSION_MINOR_STR "1"
+#define DR_VERSION_PATCH_STR "0"
+#define DR_VERSION_EXTRA "-a0"
+#endif // DR_VERSION_H
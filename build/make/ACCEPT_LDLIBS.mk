@@ -0,0 +1 @@
+ACCEPT_LDLIBS=
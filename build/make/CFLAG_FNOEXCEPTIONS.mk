@@ -0,0 +1 @@
+CFLAG_FNOEXCEPTIONS=-fno-exceptions
@@ -0,0 +1 @@
+CFLAG_FNOUNWINDTABLES=-fno-unwind-tables
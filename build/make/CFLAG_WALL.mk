@@ -0,0 +1 @@
+CFLAG_WALL=-Wall
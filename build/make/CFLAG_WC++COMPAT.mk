@@ -0,0 +1 @@
+CFLAG_WC++COMPAT=-Wc++-compat
@@ -0,0 +1 @@
+CFLAG_WDOUBLEPROMOTION=-Wdouble-promotion
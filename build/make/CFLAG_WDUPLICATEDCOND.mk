@@ -0,0 +1 @@
+CFLAG_WDUPLICATEDCOND=-Wduplicated-cond
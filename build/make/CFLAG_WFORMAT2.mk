@@ -0,0 +1 @@
+CFLAG_WFORMAT2=-Wformat=2
@@ -0,0 +1 @@
+CFLAG_WJUMPMISSESINIT=-Wjump-misses-init
@@ -0,0 +1 @@
+CFLAG_WLOGICALOP=-Wlogical-op
@@ -0,0 +1 @@
+CFLAG_WMISSINGPROTOTYPES=-Wmissing-prototypes
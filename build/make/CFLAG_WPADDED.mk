@@ -0,0 +1 @@
+CFLAG_WPADDED=-Wpadded
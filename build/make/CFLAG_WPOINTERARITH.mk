@@ -0,0 +1 @@
+CFLAG_WPOINTERARITH=-Wpointer-arith
@@ -0,0 +1 @@
+CFLAG_WSTRICTPROTOTYPES=-Wstrict-prototypes
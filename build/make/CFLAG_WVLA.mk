@@ -0,0 +1 @@
+CFLAG_WVLA=-Wvla
@@ -0,0 +1 @@
+CFLAG_WWRITESTRINGS=-Wwrite-strings
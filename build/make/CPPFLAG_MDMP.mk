@@ -0,0 +1 @@
+CPPFLAG_MDMP=-MD -MP
@@ -0,0 +1,32 @@
+CFLAG_WFAILS=
+CFLAG_WALL=-Wall
+CFLAG_WEXTRA=-Wextra
+CFLAG_WC++COMPAT=-Wc++-compat
+CFLAG_WCASTQUAL=-Wcast-qual
+CFLAG_WDOUBLEPROMOTION=-Wdouble-promotion
+CFLAG_WDUPLICATEDBRANCHES=-Wduplicated-branches
+CFLAG_WDUPLICATEDCOND=-Wduplicated-cond
+CFLAG_WFAM=
+CFLAG_WFORMAT2=-Wformat=2
+CFLAG_WIMPLICITFUNCTIONDECLARATION=-Wimplicit-function-declaration
+CFLAG_WJUMPMISSESINIT=-Wjump-misses-init
+CFLAG_WLOGICALOP=-Wlogical-op
+CFLAG_WMISSINGPROTOTYPES=-Wmissing-prototypes
+CFLAG_WNULLDEREFERENCE=-Wnull-dereference
+CFLAG_WOLDSTYLEDEFINITION=-Wold-style-definition
+CFLAG_WPADDED=-Wpadded
+CFLAG_WPOINTERARITH=-Wpointer-arith
+CFLAG_WRESTRICT=-Wrestrict
+CFLAG_WSHADOW=-Wshadow
+CFLAG_WSTRICTPROTOTYPES=-Wstrict-prototypes
+CFLAG_WVLA=-Wvla
+CFLAG_WWRITESTRINGS=-Wwrite-strings
+CFLAG_WANOEXECSTACK=-Wa,--noexecstack
+CFLAG_FNOASYNCHRONOUSUNWINDTABLES=-fno-asynchronous-unwind-tables
+CFLAG_FNOEXCEPTIONS=-fno-exceptions
+CFLAG_FNOUNWINDTABLES=-fno-unwind-tables
+CFLAG_FOMITFRAMEPOINTER=-fomit-frame-pointer
+CFLAG_FPIE=-fpie
+CFLAG_FVISIBILITYHIDDEN=-fvisibility=hidden
+CFLAG_PIPE=-pipe
+CFLAG_NOLOGO=
@@ -0,0 +1,5 @@
+OUTPUT_C=-c -o 
+OUTPUT_L=-o 
+LDLIB_PREFIX=-l
+AEXT=.S
+LEXT=
@@ -0,0 +1,2 @@
+CPPFLAG_WUNDEF=-Wundef
+CPPFLAG_MDMP=-MD -MP
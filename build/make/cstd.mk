@@ -0,0 +1 @@
+CSTD=-std=gnu11
@@ -0,0 +1,17 @@
+SHELL=/usr/bin/sh
+CC=/usr/bin/cc
+CCAS=/usr/bin/cc
+CPPFLAGS=
+CFLAGS=
+LDFLAGS=
+LDLIBS=
+PROJROOT=
+PREFIX=/usr/local
+OUTPUT_C=-c -o 
+OUTPUT_L=-o 
+LDLIB_PREFIX=-l
+AEXT=.S
+LEXT=
+EEXT=
+OEXT=.o
+CSTD=-std=gnu11
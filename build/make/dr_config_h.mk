@@ -0,0 +1,322 @@
+# SPDX-License-Identifier: GPL-2.0-only
+# Copyright (c) 2018 Drew Richardson <drewrichardson@gmail.com>
+
+build/include/DR_ALWAYS_FAILS.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_FAILS.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_ALWAYS_FAILS.c $(OUTPUT_L)DR_ALWAYS_FAILS$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_ALWAYS_FAILS 1'; \
+else \
+    echo '/* #undef DR_ALWAYS_FAILS */'; \
+fi > $@
+
+build/include/DR_ALWAYS_SUCCEEDS.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(OUTPUT_L)DR_ALWAYS_SUCCEEDS$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_ALWAYS_SUCCEEDS 1'; \
+else \
+    echo '/* #undef DR_ALWAYS_SUCCEEDS */'; \
+fi > $@
+
+build/include/DR_HAS_ACCEPT4.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_ACCEPT4.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_ACCEPT4.c $(OUTPUT_L)DR_HAS_ACCEPT4$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_ACCEPT4 1'; \
+else \
+    echo '/* #undef DR_HAS_ACCEPT4 */'; \
+fi > $@
+
+build/include/DR_HAS_ANON_STRUCT_FIELDS.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_ANON_STRUCT_FIELDS.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_ANON_STRUCT_FIELDS.c $(OUTPUT_L)DR_HAS_ANON_STRUCT_FIELDS$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_ANON_STRUCT_FIELDS 1'; \
+else \
+    echo '/* #undef DR_HAS_ANON_STRUCT_FIELDS */'; \
+fi > $@
+
+build/include/DR_HAS_ATTRIBUTE_ALIGNED.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_ATTRIBUTE_ALIGNED.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_ATTRIBUTE_ALIGNED.c $(OUTPUT_L)DR_HAS_ATTRIBUTE_ALIGNED$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_ATTRIBUTE_ALIGNED 1'; \
+else \
+    echo '/* #undef DR_HAS_ATTRIBUTE_ALIGNED */'; \
+fi > $@
+
+build/include/DR_HAS_ATTRIBUTE_FORCE_ALIGN_ARG_POINTER.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_ATTRIBUTE_FORCE_ALIGN_ARG_POINTER.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_ATTRIBUTE_FORCE_ALIGN_ARG_POINTER.c $(OUTPUT_L)DR_HAS_ATTRIBUTE_FORCE_ALIGN_ARG_POINTER$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_ATTRIBUTE_FORCE_ALIGN_ARG_POINTER 1'; \
+else \
+    echo '/* #undef DR_HAS_ATTRIBUTE_FORCE_ALIGN_ARG_POINTER */'; \
+fi > $@
+
+build/include/DR_HAS_ATTRIBUTE_FORMAT_PRINTF.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_ATTRIBUTE_FORMAT_PRINTF.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_ATTRIBUTE_FORMAT_PRINTF.c $(OUTPUT_L)DR_HAS_ATTRIBUTE_FORMAT_PRINTF$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_ATTRIBUTE_FORMAT_PRINTF 1'; \
+else \
+    echo '/* #undef DR_HAS_ATTRIBUTE_FORMAT_PRINTF */'; \
+fi > $@
+
+build/include/DR_HAS_ATTRIBUTE_NOINLINE.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_ATTRIBUTE_NOINLINE.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_ATTRIBUTE_NOINLINE.c $(OUTPUT_L)DR_HAS_ATTRIBUTE_NOINLINE$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_ATTRIBUTE_NOINLINE 1'; \
+else \
+    echo '/* #undef DR_HAS_ATTRIBUTE_NOINLINE */'; \
+fi > $@
+
+build/include/DR_HAS_ATTRIBUTE_NORETURN.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_ATTRIBUTE_NORETURN.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_ATTRIBUTE_NORETURN.c $(OUTPUT_L)DR_HAS_ATTRIBUTE_NORETURN$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_ATTRIBUTE_NORETURN 1'; \
+else \
+    echo '/* #undef DR_HAS_ATTRIBUTE_NORETURN */'; \
+fi > $@
+
+build/include/DR_HAS_ATTRIBUTE_WARN_UNUSED_RESULT.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_ATTRIBUTE_WARN_UNUSED_RESULT.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_ATTRIBUTE_WARN_UNUSED_RESULT.c $(OUTPUT_L)DR_HAS_ATTRIBUTE_WARN_UNUSED_RESULT$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_ATTRIBUTE_WARN_UNUSED_RESULT 1'; \
+else \
+    echo '/* #undef DR_HAS_ATTRIBUTE_WARN_UNUSED_RESULT */'; \
+fi > $@
+
+build/include/DR_HAS_BUILTIN_EXPECT.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_BUILTIN_EXPECT.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_BUILTIN_EXPECT.c $(OUTPUT_L)DR_HAS_BUILTIN_EXPECT$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_BUILTIN_EXPECT 1'; \
+else \
+    echo '/* #undef DR_HAS_BUILTIN_EXPECT */'; \
+fi > $@
+
+build/include/DR_HAS_COMPOUND_LITERALS.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_COMPOUND_LITERALS.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_COMPOUND_LITERALS.c $(OUTPUT_L)DR_HAS_COMPOUND_LITERALS$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_COMPOUND_LITERALS 1'; \
+else \
+    echo '/* #undef DR_HAS_COMPOUND_LITERALS */'; \
+fi > $@
+
+build/include/DR_HAS_DECLSPEC_NOINLINE.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_DECLSPEC_NOINLINE.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_DECLSPEC_NOINLINE.c $(OUTPUT_L)DR_HAS_DECLSPEC_NOINLINE$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_DECLSPEC_NOINLINE 1'; \
+else \
+    echo '/* #undef DR_HAS_DECLSPEC_NOINLINE */'; \
+fi > $@
+
+build/include/DR_HAS_DECLSPEC_NORETURN.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_DECLSPEC_NORETURN.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_DECLSPEC_NORETURN.c $(OUTPUT_L)DR_HAS_DECLSPEC_NORETURN$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_DECLSPEC_NORETURN 1'; \
+else \
+    echo '/* #undef DR_HAS_DECLSPEC_NORETURN */'; \
+fi > $@
+
+build/include/DR_HAS_DECLSPEC_THREAD.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_DECLSPEC_THREAD.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_DECLSPEC_THREAD.c $(OUTPUT_L)DR_HAS_DECLSPEC_THREAD$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_DECLSPEC_THREAD 1'; \
+else \
+    echo '/* #undef DR_HAS_DECLSPEC_THREAD */'; \
+fi > $@
+
+build/include/DR_HAS_DECLTYPE.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_DECLTYPE.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_DECLTYPE.c $(OUTPUT_L)DR_HAS_DECLTYPE$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_DECLTYPE 1'; \
+else \
+    echo '/* #undef DR_HAS_DECLTYPE */'; \
+fi > $@
+
+build/include/DR_HAS_DESIGNATED_INITIALIZERS.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_DESIGNATED_INITIALIZERS.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_DESIGNATED_INITIALIZERS.c $(OUTPUT_L)DR_HAS_DESIGNATED_INITIALIZERS$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_DESIGNATED_INITIALIZERS 1'; \
+else \
+    echo '/* #undef DR_HAS_DESIGNATED_INITIALIZERS */'; \
+fi > $@
+
+build/include/DR_HAS_GENERIC.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_GENERIC.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_GENERIC.c $(OUTPUT_L)DR_HAS_GENERIC$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_GENERIC 1'; \
+else \
+    echo '/* #undef DR_HAS_GENERIC */'; \
+fi > $@
+
+build/include/DR_HAS_IO_URING.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_IO_URING.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_IO_URING.c $(OUTPUT_L)DR_HAS_IO_URING$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_IO_URING 1'; \
+else \
+    echo '/* #undef DR_HAS_IO_URING */'; \
+fi > $@
+
+build/include/DR_HAS_IO_URING_MULTISHOT_ACCEPT.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_IO_URING_MULTISHOT_ACCEPT.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_IO_URING_MULTISHOT_ACCEPT.c $(OUTPUT_L)DR_HAS_IO_URING_MULTISHOT_ACCEPT$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_IO_URING_MULTISHOT_ACCEPT 1'; \
+else \
+    echo '/* #undef DR_HAS_IO_URING_MULTISHOT_ACCEPT */'; \
+fi > $@
+
+build/include/DR_HAS_KEVENT.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_KEVENT.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_KEVENT.c $(OUTPUT_L)DR_HAS_KEVENT$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_KEVENT 1'; \
+else \
+    echo '/* #undef DR_HAS_KEVENT */'; \
+fi > $@
+
+build/include/DR_HAS_MIXED_DECLARATIONS.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_MIXED_DECLARATIONS.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_MIXED_DECLARATIONS.c $(OUTPUT_L)DR_HAS_MIXED_DECLARATIONS$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_MIXED_DECLARATIONS 1'; \
+else \
+    echo '/* #undef DR_HAS_MIXED_DECLARATIONS */'; \
+fi > $@
+
+build/include/DR_HAS_NORETURN.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_NORETURN.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_NORETURN.c $(OUTPUT_L)DR_HAS_NORETURN$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_NORETURN 1'; \
+else \
+    echo '/* #undef DR_HAS_NORETURN */'; \
+fi > $@
+
+build/include/DR_HAS_RESTRICT.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_RESTRICT.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_RESTRICT.c $(OUTPUT_L)DR_HAS_RESTRICT$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_RESTRICT 1'; \
+else \
+    echo '/* #undef DR_HAS_RESTRICT */'; \
+fi > $@
+
+build/include/DR_HAS_STATEMENT_EXPRESSIONS.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_STATEMENT_EXPRESSIONS.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_STATEMENT_EXPRESSIONS.c $(OUTPUT_L)DR_HAS_STATEMENT_EXPRESSIONS$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_STATEMENT_EXPRESSIONS 1'; \
+else \
+    echo '/* #undef DR_HAS_STATEMENT_EXPRESSIONS */'; \
+fi > $@
+
+build/include/DR_HAS_THREAD_LOCAL.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_THREAD_LOCAL.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_THREAD_LOCAL.c $(OUTPUT_L)DR_HAS_THREAD_LOCAL$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_THREAD_LOCAL 1'; \
+else \
+    echo '/* #undef DR_HAS_THREAD_LOCAL */'; \
+fi > $@
+
+build/include/DR_HAS_TYPEOF.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_TYPEOF.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_TYPEOF.c $(OUTPUT_L)DR_HAS_TYPEOF$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_TYPEOF 1'; \
+else \
+    echo '/* #undef DR_HAS_TYPEOF */'; \
+fi > $@
+
+build/include/DR_HAS_VARIADIC_MACROS.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS_VARIADIC_MACROS.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS_VARIADIC_MACROS.c $(OUTPUT_L)DR_HAS_VARIADIC_MACROS$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS_VARIADIC_MACROS 1'; \
+else \
+    echo '/* #undef DR_HAS_VARIADIC_MACROS */'; \
+fi > $@
+
+build/include/DR_HAS___ALIGNOF.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS___ALIGNOF.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS___ALIGNOF.c $(OUTPUT_L)DR_HAS___ALIGNOF$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS___ALIGNOF 1'; \
+else \
+    echo '/* #undef DR_HAS___ALIGNOF */'; \
+fi > $@
+
+build/include/DR_HAS___ALIGNOF__.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS___ALIGNOF__.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS___ALIGNOF__.c $(OUTPUT_L)DR_HAS___ALIGNOF__$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS___ALIGNOF__ 1'; \
+else \
+    echo '/* #undef DR_HAS___ALIGNOF__ */'; \
+fi > $@
+
+build/include/DR_HAS___THREAD.h: build/make/dr_config.mk $(PROJROOT)config/checks/DR_HAS___THREAD.c
+	$(E_GEN) \
+if ! (cd build/make_obj && \
+        $(CC) $(CSTD) $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) ../../$(PROJROOT)config/checks/DR_HAS___THREAD.c $(OUTPUT_L)DR_HAS___THREAD$(EEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo '#define DR_HAS___THREAD 1'; \
+else \
+    echo '/* #undef DR_HAS___THREAD */'; \
+fi > $@
+
+build/include/dr_config.h: build/include/DR_ALWAYS_FAILS.h build/include/DR_ALWAYS_SUCCEEDS.h build/include/DR_HAS_ACCEPT4.h build/include/DR_HAS_ANON_STRUCT_FIELDS.h build/include/DR_HAS_ATTRIBUTE_ALIGNED.h build/include/DR_HAS_ATTRIBUTE_FORCE_ALIGN_ARG_POINTER.h build/include/DR_HAS_ATTRIBUTE_FORMAT_PRINTF.h build/include/DR_HAS_ATTRIBUTE_NOINLINE.h build/include/DR_HAS_ATTRIBUTE_NORETURN.h build/include/DR_HAS_ATTRIBUTE_WARN_UNUSED_RESULT.h build/include/DR_HAS_BUILTIN_EXPECT.h build/include/DR_HAS_COMPOUND_LITERALS.h build/include/DR_HAS_DECLSPEC_NOINLINE.h build/include/DR_HAS_DECLSPEC_NORETURN.h build/include/DR_HAS_DECLSPEC_THREAD.h build/include/DR_HAS_DECLTYPE.h build/include/DR_HAS_DESIGNATED_INITIALIZERS.h build/include/DR_HAS_GENERIC.h build/include/DR_HAS_IO_URING.h build/include/DR_HAS_IO_URING_MULTISHOT_ACCEPT.h build/include/DR_HAS_KEVENT.h build/include/DR_HAS_MIXED_DECLARATIONS.h build/include/DR_HAS_NORETURN.h build/include/DR_HAS_RESTRICT.h build/include/DR_HAS_STATEMENT_EXPRESSIONS.h build/include/DR_HAS_THREAD_LOCAL.h build/include/DR_HAS_TYPEOF.h build/include/DR_HAS_VARIADIC_MACROS.h build/include/DR_HAS___ALIGNOF.h build/include/DR_HAS___ALIGNOF__.h build/include/DR_HAS___THREAD.h
+	$(E_GEN) \
+( \
+    echo '#if !defined(DR_CONFIG_H)'; \
+    echo '#define DR_CONFIG_H'; \
+    cat  build/include/DR_ALWAYS_FAILS.h build/include/DR_ALWAYS_SUCCEEDS.h build/include/DR_HAS_ACCEPT4.h build/include/DR_HAS_ANON_STRUCT_FIELDS.h build/include/DR_HAS_ATTRIBUTE_ALIGNED.h build/include/DR_HAS_ATTRIBUTE_FORCE_ALIGN_ARG_POINTER.h build/include/DR_HAS_ATTRIBUTE_FORMAT_PRINTF.h build/include/DR_HAS_ATTRIBUTE_NOINLINE.h build/include/DR_HAS_ATTRIBUTE_NORETURN.h build/include/DR_HAS_ATTRIBUTE_WARN_UNUSED_RESULT.h build/include/DR_HAS_BUILTIN_EXPECT.h build/include/DR_HAS_COMPOUND_LITERALS.h build/include/DR_HAS_DECLSPEC_NOINLINE.h build/include/DR_HAS_DECLSPEC_NORETURN.h build/include/DR_HAS_DECLSPEC_THREAD.h build/include/DR_HAS_DECLTYPE.h build/include/DR_HAS_DESIGNATED_INITIALIZERS.h build/include/DR_HAS_GENERIC.h build/include/DR_HAS_IO_URING.h build/include/DR_HAS_IO_URING_MULTISHOT_ACCEPT.h build/include/DR_HAS_KEVENT.h build/include/DR_HAS_MIXED_DECLARATIONS.h build/include/DR_HAS_NORETURN.h build/include/DR_HAS_RESTRICT.h build/include/DR_HAS_STATEMENT_EXPRESSIONS.h build/include/DR_HAS_THREAD_LOCAL.h build/include/DR_HAS_TYPEOF.h build/include/DR_HAS_VARIADIC_MACROS.h build/include/DR_HAS___ALIGNOF.h build/include/DR_HAS___ALIGNOF__.h build/include/DR_HAS___THREAD.h; \
+    echo '#endif // DR_CONFIG_H'\
+) > $@
+
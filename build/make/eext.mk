@@ -0,0 +1 @@
+EEXT=
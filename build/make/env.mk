@@ -0,0 +1,9 @@
+SHELL=/usr/bin/sh
+CC=/usr/bin/cc
+CCAS=/usr/bin/cc
+CPPFLAGS=
+CFLAGS=
+LDFLAGS=
+LDLIBS=
+PROJROOT=
+PREFIX=/usr/local
@@ -0,0 +1,417 @@
+# SPDX-License-Identifier: GPL-2.0-only
+# Copyright (c) 2018 Drew Richardson <drewrichardson@gmail.com>
+
+build/make/CPPFLAG_WUNDEF.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WUNDEF.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wundef $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WUNDEF.c $(OUTPUT_L)CPPFLAG_WUNDEF$(EEXT) && \
+        $(CCAS) -Wundef $(CPPFLAGS) $(OUTPUT_C)CPPFLAG_WUNDEF$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CPPFLAG_WUNDEF=-Wundef; \
+else \
+    echo CPPFLAG_WUNDEF=; \
+fi > $@
+
+build/make/CPPFLAG_MDMP.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.MDMP.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -MD -MP $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.MDMP.c $(OUTPUT_L)CPPFLAG_MDMP$(EEXT) && \
+        $(CCAS) -MD -MP $(CPPFLAGS) $(OUTPUT_C)CPPFLAG_MDMP$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CPPFLAG_MDMP=-MD -MP; \
+else \
+    echo CPPFLAG_MDMP=; \
+fi > $@
+
+build/make/cppflags.mk: build/make/CPPFLAG_WUNDEF.mk build/make/CPPFLAG_MDMP.mk
+	$(E_GEN)cat build/make/CPPFLAG_WUNDEF.mk build/make/CPPFLAG_MDMP.mk > $@
+
+build/make/CFLAG_WFAILS.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WFAILS.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wfails $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WFAILS.c $(OUTPUT_L)CFLAG_WFAILS$(EEXT) && \
+        $(CCAS) -Wfails $(CPPFLAGS) $(OUTPUT_C)CFLAG_WFAILS$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WFAILS=-Wfails; \
+else \
+    echo CFLAG_WFAILS=; \
+fi > $@
+
+build/make/CFLAG_WALL.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WALL.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wall $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WALL.c $(OUTPUT_L)CFLAG_WALL$(EEXT) && \
+        $(CCAS) -Wall $(CPPFLAGS) $(OUTPUT_C)CFLAG_WALL$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WALL=-Wall; \
+else \
+    echo CFLAG_WALL=; \
+fi > $@
+
+build/make/CFLAG_WEXTRA.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WEXTRA.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wextra $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WEXTRA.c $(OUTPUT_L)CFLAG_WEXTRA$(EEXT) && \
+        $(CCAS) -Wextra $(CPPFLAGS) $(OUTPUT_C)CFLAG_WEXTRA$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WEXTRA=-Wextra; \
+else \
+    echo CFLAG_WEXTRA=; \
+fi > $@
+
+build/make/CFLAG_WC++COMPAT.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WC++COMPAT.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wc++-compat $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WC++COMPAT.c $(OUTPUT_L)CFLAG_WC++COMPAT$(EEXT) && \
+        $(CCAS) -Wc++-compat $(CPPFLAGS) $(OUTPUT_C)CFLAG_WC++COMPAT$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WC++COMPAT=-Wc++-compat; \
+else \
+    echo CFLAG_WC++COMPAT=; \
+fi > $@
+
+build/make/CFLAG_WCASTQUAL.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WCASTQUAL.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wcast-qual $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WCASTQUAL.c $(OUTPUT_L)CFLAG_WCASTQUAL$(EEXT) && \
+        $(CCAS) -Wcast-qual $(CPPFLAGS) $(OUTPUT_C)CFLAG_WCASTQUAL$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WCASTQUAL=-Wcast-qual; \
+else \
+    echo CFLAG_WCASTQUAL=; \
+fi > $@
+
+build/make/CFLAG_WDOUBLEPROMOTION.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WDOUBLEPROMOTION.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wdouble-promotion $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WDOUBLEPROMOTION.c $(OUTPUT_L)CFLAG_WDOUBLEPROMOTION$(EEXT) && \
+        $(CCAS) -Wdouble-promotion $(CPPFLAGS) $(OUTPUT_C)CFLAG_WDOUBLEPROMOTION$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WDOUBLEPROMOTION=-Wdouble-promotion; \
+else \
+    echo CFLAG_WDOUBLEPROMOTION=; \
+fi > $@
+
+build/make/CFLAG_WDUPLICATEDBRANCHES.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WDUPLICATEDBRANCHES.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wduplicated-branches $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WDUPLICATEDBRANCHES.c $(OUTPUT_L)CFLAG_WDUPLICATEDBRANCHES$(EEXT) && \
+        $(CCAS) -Wduplicated-branches $(CPPFLAGS) $(OUTPUT_C)CFLAG_WDUPLICATEDBRANCHES$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WDUPLICATEDBRANCHES=-Wduplicated-branches; \
+else \
+    echo CFLAG_WDUPLICATEDBRANCHES=; \
+fi > $@
+
+build/make/CFLAG_WDUPLICATEDCOND.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WDUPLICATEDCOND.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wduplicated-cond $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WDUPLICATEDCOND.c $(OUTPUT_L)CFLAG_WDUPLICATEDCOND$(EEXT) && \
+        $(CCAS) -Wduplicated-cond $(CPPFLAGS) $(OUTPUT_C)CFLAG_WDUPLICATEDCOND$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WDUPLICATEDCOND=-Wduplicated-cond; \
+else \
+    echo CFLAG_WDUPLICATEDCOND=; \
+fi > $@
+
+build/make/CFLAG_WFAM.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WFAM.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wfam $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WFAM.c $(OUTPUT_L)CFLAG_WFAM$(EEXT) && \
+        $(CCAS) -Wfam $(CPPFLAGS) $(OUTPUT_C)CFLAG_WFAM$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WFAM=-Wfam; \
+else \
+    echo CFLAG_WFAM=; \
+fi > $@
+
+build/make/CFLAG_WFORMAT2.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WFORMAT2.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wformat=2 $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WFORMAT2.c $(OUTPUT_L)CFLAG_WFORMAT2$(EEXT) && \
+        $(CCAS) -Wformat=2 $(CPPFLAGS) $(OUTPUT_C)CFLAG_WFORMAT2$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WFORMAT2=-Wformat=2; \
+else \
+    echo CFLAG_WFORMAT2=; \
+fi > $@
+
+build/make/CFLAG_WIMPLICITFUNCTIONDECLARATION.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WIMPLICITFUNCTIONDECLARATION.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wimplicit-function-declaration $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WIMPLICITFUNCTIONDECLARATION.c $(OUTPUT_L)CFLAG_WIMPLICITFUNCTIONDECLARATION$(EEXT) && \
+        $(CCAS) -Wimplicit-function-declaration $(CPPFLAGS) $(OUTPUT_C)CFLAG_WIMPLICITFUNCTIONDECLARATION$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WIMPLICITFUNCTIONDECLARATION=-Wimplicit-function-declaration; \
+else \
+    echo CFLAG_WIMPLICITFUNCTIONDECLARATION=; \
+fi > $@
+
+build/make/CFLAG_WJUMPMISSESINIT.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WJUMPMISSESINIT.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wjump-misses-init $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WJUMPMISSESINIT.c $(OUTPUT_L)CFLAG_WJUMPMISSESINIT$(EEXT) && \
+        $(CCAS) -Wjump-misses-init $(CPPFLAGS) $(OUTPUT_C)CFLAG_WJUMPMISSESINIT$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WJUMPMISSESINIT=-Wjump-misses-init; \
+else \
+    echo CFLAG_WJUMPMISSESINIT=; \
+fi > $@
+
+build/make/CFLAG_WLOGICALOP.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WLOGICALOP.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wlogical-op $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WLOGICALOP.c $(OUTPUT_L)CFLAG_WLOGICALOP$(EEXT) && \
+        $(CCAS) -Wlogical-op $(CPPFLAGS) $(OUTPUT_C)CFLAG_WLOGICALOP$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WLOGICALOP=-Wlogical-op; \
+else \
+    echo CFLAG_WLOGICALOP=; \
+fi > $@
+
+build/make/CFLAG_WMISSINGPROTOTYPES.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WMISSINGPROTOTYPES.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wmissing-prototypes $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WMISSINGPROTOTYPES.c $(OUTPUT_L)CFLAG_WMISSINGPROTOTYPES$(EEXT) && \
+        $(CCAS) -Wmissing-prototypes $(CPPFLAGS) $(OUTPUT_C)CFLAG_WMISSINGPROTOTYPES$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WMISSINGPROTOTYPES=-Wmissing-prototypes; \
+else \
+    echo CFLAG_WMISSINGPROTOTYPES=; \
+fi > $@
+
+build/make/CFLAG_WNULLDEREFERENCE.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WNULLDEREFERENCE.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wnull-dereference $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WNULLDEREFERENCE.c $(OUTPUT_L)CFLAG_WNULLDEREFERENCE$(EEXT) && \
+        $(CCAS) -Wnull-dereference $(CPPFLAGS) $(OUTPUT_C)CFLAG_WNULLDEREFERENCE$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WNULLDEREFERENCE=-Wnull-dereference; \
+else \
+    echo CFLAG_WNULLDEREFERENCE=; \
+fi > $@
+
+build/make/CFLAG_WOLDSTYLEDEFINITION.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WOLDSTYLEDEFINITION.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wold-style-definition $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WOLDSTYLEDEFINITION.c $(OUTPUT_L)CFLAG_WOLDSTYLEDEFINITION$(EEXT) && \
+        $(CCAS) -Wold-style-definition $(CPPFLAGS) $(OUTPUT_C)CFLAG_WOLDSTYLEDEFINITION$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WOLDSTYLEDEFINITION=-Wold-style-definition; \
+else \
+    echo CFLAG_WOLDSTYLEDEFINITION=; \
+fi > $@
+
+build/make/CFLAG_WPADDED.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WPADDED.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wpadded $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WPADDED.c $(OUTPUT_L)CFLAG_WPADDED$(EEXT) && \
+        $(CCAS) -Wpadded $(CPPFLAGS) $(OUTPUT_C)CFLAG_WPADDED$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WPADDED=-Wpadded; \
+else \
+    echo CFLAG_WPADDED=; \
+fi > $@
+
+build/make/CFLAG_WPOINTERARITH.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WPOINTERARITH.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wpointer-arith $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WPOINTERARITH.c $(OUTPUT_L)CFLAG_WPOINTERARITH$(EEXT) && \
+        $(CCAS) -Wpointer-arith $(CPPFLAGS) $(OUTPUT_C)CFLAG_WPOINTERARITH$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WPOINTERARITH=-Wpointer-arith; \
+else \
+    echo CFLAG_WPOINTERARITH=; \
+fi > $@
+
+build/make/CFLAG_WRESTRICT.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WRESTRICT.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wrestrict $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WRESTRICT.c $(OUTPUT_L)CFLAG_WRESTRICT$(EEXT) && \
+        $(CCAS) -Wrestrict $(CPPFLAGS) $(OUTPUT_C)CFLAG_WRESTRICT$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WRESTRICT=-Wrestrict; \
+else \
+    echo CFLAG_WRESTRICT=; \
+fi > $@
+
+build/make/CFLAG_WSHADOW.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WSHADOW.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wshadow $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WSHADOW.c $(OUTPUT_L)CFLAG_WSHADOW$(EEXT) && \
+        $(CCAS) -Wshadow $(CPPFLAGS) $(OUTPUT_C)CFLAG_WSHADOW$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WSHADOW=-Wshadow; \
+else \
+    echo CFLAG_WSHADOW=; \
+fi > $@
+
+build/make/CFLAG_WSTRICTPROTOTYPES.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WSTRICTPROTOTYPES.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wstrict-prototypes $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WSTRICTPROTOTYPES.c $(OUTPUT_L)CFLAG_WSTRICTPROTOTYPES$(EEXT) && \
+        $(CCAS) -Wstrict-prototypes $(CPPFLAGS) $(OUTPUT_C)CFLAG_WSTRICTPROTOTYPES$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WSTRICTPROTOTYPES=-Wstrict-prototypes; \
+else \
+    echo CFLAG_WSTRICTPROTOTYPES=; \
+fi > $@
+
+build/make/CFLAG_WVLA.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WVLA.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wvla $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WVLA.c $(OUTPUT_L)CFLAG_WVLA$(EEXT) && \
+        $(CCAS) -Wvla $(CPPFLAGS) $(OUTPUT_C)CFLAG_WVLA$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WVLA=-Wvla; \
+else \
+    echo CFLAG_WVLA=; \
+fi > $@
+
+build/make/CFLAG_WWRITESTRINGS.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WWRITESTRINGS.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wwrite-strings $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WWRITESTRINGS.c $(OUTPUT_L)CFLAG_WWRITESTRINGS$(EEXT) && \
+        $(CCAS) -Wwrite-strings $(CPPFLAGS) $(OUTPUT_C)CFLAG_WWRITESTRINGS$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WWRITESTRINGS=-Wwrite-strings; \
+else \
+    echo CFLAG_WWRITESTRINGS=; \
+fi > $@
+
+build/make/CFLAG_WANOEXECSTACK.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.WANOEXECSTACK.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -Wa,--noexecstack $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.WANOEXECSTACK.c $(OUTPUT_L)CFLAG_WANOEXECSTACK$(EEXT) && \
+        $(CCAS) -Wa,--noexecstack $(CPPFLAGS) $(OUTPUT_C)CFLAG_WANOEXECSTACK$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_WANOEXECSTACK=-Wa,--noexecstack; \
+else \
+    echo CFLAG_WANOEXECSTACK=; \
+fi > $@
+
+build/make/CFLAG_FNOASYNCHRONOUSUNWINDTABLES.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.FNOASYNCHRONOUSUNWINDTABLES.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -fno-asynchronous-unwind-tables $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.FNOASYNCHRONOUSUNWINDTABLES.c $(OUTPUT_L)CFLAG_FNOASYNCHRONOUSUNWINDTABLES$(EEXT) && \
+        $(CCAS) -fno-asynchronous-unwind-tables $(CPPFLAGS) $(OUTPUT_C)CFLAG_FNOASYNCHRONOUSUNWINDTABLES$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_FNOASYNCHRONOUSUNWINDTABLES=-fno-asynchronous-unwind-tables; \
+else \
+    echo CFLAG_FNOASYNCHRONOUSUNWINDTABLES=; \
+fi > $@
+
+build/make/CFLAG_FNOEXCEPTIONS.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.FNOEXCEPTIONS.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -fno-exceptions $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.FNOEXCEPTIONS.c $(OUTPUT_L)CFLAG_FNOEXCEPTIONS$(EEXT) && \
+        $(CCAS) -fno-exceptions $(CPPFLAGS) $(OUTPUT_C)CFLAG_FNOEXCEPTIONS$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_FNOEXCEPTIONS=-fno-exceptions; \
+else \
+    echo CFLAG_FNOEXCEPTIONS=; \
+fi > $@
+
+build/make/CFLAG_FNOUNWINDTABLES.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.FNOUNWINDTABLES.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -fno-unwind-tables $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.FNOUNWINDTABLES.c $(OUTPUT_L)CFLAG_FNOUNWINDTABLES$(EEXT) && \
+        $(CCAS) -fno-unwind-tables $(CPPFLAGS) $(OUTPUT_C)CFLAG_FNOUNWINDTABLES$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_FNOUNWINDTABLES=-fno-unwind-tables; \
+else \
+    echo CFLAG_FNOUNWINDTABLES=; \
+fi > $@
+
+build/make/CFLAG_FOMITFRAMEPOINTER.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.FOMITFRAMEPOINTER.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -fomit-frame-pointer $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.FOMITFRAMEPOINTER.c $(OUTPUT_L)CFLAG_FOMITFRAMEPOINTER$(EEXT) && \
+        $(CCAS) -fomit-frame-pointer $(CPPFLAGS) $(OUTPUT_C)CFLAG_FOMITFRAMEPOINTER$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_FOMITFRAMEPOINTER=-fomit-frame-pointer; \
+else \
+    echo CFLAG_FOMITFRAMEPOINTER=; \
+fi > $@
+
+build/make/CFLAG_FPIE.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.FPIE.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -fpie $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.FPIE.c $(OUTPUT_L)CFLAG_FPIE$(EEXT) && \
+        $(CCAS) -fpie $(CPPFLAGS) $(OUTPUT_C)CFLAG_FPIE$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_FPIE=-fpie; \
+else \
+    echo CFLAG_FPIE=; \
+fi > $@
+
+build/make/CFLAG_FVISIBILITYHIDDEN.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.FVISIBILITYHIDDEN.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -fvisibility=hidden $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.FVISIBILITYHIDDEN.c $(OUTPUT_L)CFLAG_FVISIBILITYHIDDEN$(EEXT) && \
+        $(CCAS) -fvisibility=hidden $(CPPFLAGS) $(OUTPUT_C)CFLAG_FVISIBILITYHIDDEN$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_FVISIBILITYHIDDEN=-fvisibility=hidden; \
+else \
+    echo CFLAG_FVISIBILITYHIDDEN=; \
+fi > $@
+
+build/make/CFLAG_PIPE.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.PIPE.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) -pipe $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.PIPE.c $(OUTPUT_L)CFLAG_PIPE$(EEXT) && \
+        $(CCAS) -pipe $(CPPFLAGS) $(OUTPUT_C)CFLAG_PIPE$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_PIPE=-pipe; \
+else \
+    echo CFLAG_PIPE=; \
+fi > $@
+
+build/make/CFLAG_NOLOGO.mk: build/make/dr_config.mk $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT)
+	$(E_GEN) \
+if ! (cp $(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS.c build/make_obj/DR_ALWAYS_SUCCEEDS.NOLOGO.c && \
+        cd build/make_obj && \
+        $(CC) $(CSTD) /nologo $(CPPFLAGS) $(CFLAGS) $(LDFLAGS) DR_ALWAYS_SUCCEEDS.NOLOGO.c $(OUTPUT_L)CFLAG_NOLOGO$(EEXT) && \
+        $(CCAS) /nologo $(CPPFLAGS) $(OUTPUT_C)CFLAG_NOLOGO$(OEXT) ../../$(PROJROOT)config/checks/DR_ALWAYS_SUCCEEDS$(AEXT) || \
+        echo error) 2>&1 | egrep -i 'error|warn' > /dev/null; then \
+    echo CFLAG_NOLOGO=/nologo; \
+else \
+    echo CFLAG_NOLOGO=; \
+fi > $@
+
+build/make/cflags.mk: build/make/CFLAG_WFAILS.mk build/make/CFLAG_WALL.mk build/make/CFLAG_WEXTRA.mk build/make/CFLAG_WC++COMPAT.mk build/make/CFLAG_WCASTQUAL.mk build/make/CFLAG_WDOUBLEPROMOTION.mk build/make/CFLAG_WDUPLICATEDBRANCHES.mk build/make/CFLAG_WDUPLICATEDCOND.mk build/make/CFLAG_WFAM.mk build/make/CFLAG_WFORMAT2.mk build/make/CFLAG_WIMPLICITFUNCTIONDECLARATION.mk build/make/CFLAG_WJUMPMISSESINIT.mk build/make/CFLAG_WLOGICALOP.mk build/make/CFLAG_WMISSINGPROTOTYPES.mk build/make/CFLAG_WNULLDEREFERENCE.mk build/make/CFLAG_WOLDSTYLEDEFINITION.mk build/make/CFLAG_WPADDED.mk build/make/CFLAG_WPOINTERARITH.mk build/make/CFLAG_WRESTRICT.mk build/make/CFLAG_WSHADOW.mk build/make/CFLAG_WSTRICTPROTOTYPES.mk build/make/CFLAG_WVLA.mk build/make/CFLAG_WWRITESTRINGS.mk build/make/CFLAG_WANOEXECSTACK.mk build/make/CFLAG_FNOASYNCHRONOUSUNWINDTABLES.mk build/make/CFLAG_FNOEXCEPTIONS.mk build/make/CFLAG_FNOUNWINDTABLES.mk build/make/CFLAG_FOMITFRAMEPOINTER.mk build/make/CFLAG_FPIE.mk build/make/CFLAG_FVISIBILITYHIDDEN.mk build/make/CFLAG_PIPE.mk build/make/CFLAG_NOLOGO.mk
+	$(E_GEN)cat build/make/CFLAG_WFAILS.mk build/make/CFLAG_WALL.mk build/make/CFLAG_WEXTRA.mk build/make/CFLAG_WC++COMPAT.mk build/make/CFLAG_WCASTQUAL.mk build/make/CFLAG_WDOUBLEPROMOTION.mk build/make/CFLAG_WDUPLICATEDBRANCHES.mk build/make/CFLAG_WDUPLICATEDCOND.mk build/make/CFLAG_WFAM.mk build/make/CFLAG_WFORMAT2.mk build/make/CFLAG_WIMPLICITFUNCTIONDECLARATION.mk build/make/CFLAG_WJUMPMISSESINIT.mk build/make/CFLAG_WLOGICALOP.mk build/make/CFLAG_WMISSINGPROTOTYPES.mk build/make/CFLAG_WNULLDEREFERENCE.mk build/make/CFLAG_WOLDSTYLEDEFINITION.mk build/make/CFLAG_WPADDED.mk build/make/CFLAG_WPOINTERARITH.mk build/make/CFLAG_WRESTRICT.mk build/make/CFLAG_WSHADOW.mk build/make/CFLAG_WSTRICTPROTOTYPES.mk build/make/CFLAG_WVLA.mk build/make/CFLAG_WWRITESTRINGS.mk build/make/CFLAG_WANOEXECSTACK.mk build/make/CFLAG_FNOASYNCHRONOUSUNWINDTABLES.mk build/make/CFLAG_FNOEXCEPTIONS.mk build/make/CFLAG_FNOUNWINDTABLES.mk build/make/CFLAG_FOMITFRAMEPOINTER.mk build/make/CFLAG_FPIE.mk build/make/CFLAG_FVISIBILITYHIDDEN.mk build/make/CFLAG_PIPE.mk build/make/CFLAG_NOLOGO.mk > $@
+
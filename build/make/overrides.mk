@@ -0,0 +1,2 @@
+dr_task_destroy_on_do.S=x86_64/
+dr_task_switch.S=x86_64/
@@ -0,0 +1,2 @@
+MACHINE=x86_64
+OS=linux
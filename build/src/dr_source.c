@@ -0,0 +1,4 @@
+#include "dr.h"
+const char *dr_source_revision(void) { return "e07d1ba963ed8efc78e26278288027f79a4f746d"; }
+const char *dr_source_status(void) { return "dirty"; }
+const char *dr_source_date(void) { return "2026-10-18T07:39:16+00:00"; }